@@ -0,0 +1,95 @@
+#include "CombatRules.h"
+#include <algorithm> // Untuk std::max, std::min
+
+namespace {
+
+int hitDamage(int attack, float multiplier, int defense) {
+    return std::max(1, static_cast<int>(attack * multiplier) - defense);
+}
+
+// Pengali damage per hit untuk tiap aksi serang.
+float damageMultiplierOf(char action) {
+    switch (action) {
+        case 'B': return 0.4f; // Rising Slash
+        case 'C': return 0.8f; // Sword Dance
+        case 'D': return 0.6f; // Shining Arrow
+        case 'E': return 2.5f; // Samsara
+        default: return 1.0f;  // Serangan biasa
+    }
+}
+
+} // namespace
+
+int getCombatActionSpCost(char action) {
+    switch (action) {
+        case 'B': return 15;
+        case 'C': return 40;
+        case 'D': return 30;
+        case 'E': return 60;
+        default: return 0;
+    }
+}
+
+bool isKnownCombatAction(char action) {
+    return action >= 'A' && action <= 'F';
+}
+
+double expectedCombatActionDamage(char action, const PlayerStats& player, const Enemy& enemy) {
+    if (action < 'A' || action > 'E') return 0.0;
+    int perHit = hitDamage(player.attack, damageMultiplierOf(action), enemy.defense);
+    switch (action) {
+        case 'B': return 4.2 * perHit; // 30% 5 hit, 60% 4 hit, 10% 3 hit
+        case 'C': return 8.0 * perHit;
+        case 'D': return 6.0 * perHit; // 4-8 hit merata
+        default: return perHit;
+    }
+}
+
+PlayerActionResult applyPlayerCombatAction(char action, PlayerStats& player, Enemy& enemy, const CombatRoll& roll) {
+    PlayerActionResult result = {false, getCombatActionSpCost(action), 0, 0, 0, DefendResolution::NONE};
+    if (!isKnownCombatAction(action) || player.sp < result.spCost) return result;
+    result.performed = true;
+    player.sp -= result.spCost;
+
+    switch (action) {
+        case 'B': {
+            int roll_hits = roll(100);
+            result.hits = (roll_hits < 30) ? 5 : (roll_hits < 90) ? 4 : 3;
+            break;
+        }
+        case 'C': result.hits = 8; break;
+        case 'D': result.hits = roll(5) + 4; break;
+        case 'F': {
+            int defendRoll = roll(100);
+            if (defendRoll < 50) { result.defendOutcome = DefendResolution::EVADE_REGEN; }
+            else if (defendRoll < 65) { result.defendOutcome = DefendResolution::HIT_THROUGH; }
+            else { result.defendOutcome = DefendResolution::SUCCESSFUL_BLOCK; }
+            return result;
+        }
+        default: result.hits = 1; break; // 'A' dan 'E'
+    }
+    result.damagePerHit = hitDamage(player.attack, damageMultiplierOf(action), enemy.defense);
+    result.totalDamage = result.hits * result.damagePerHit;
+    enemy.hp = std::max(0, enemy.hp - result.totalDamage);
+    return result;
+}
+
+int applyEnemyCombatTurn(DefendResolution defendOutcome, PlayerStats& player, const Enemy& enemy) {
+    int damageTaken = 0;
+    switch (defendOutcome) {
+        case DefendResolution::EVADE_REGEN:
+            player.hp = std::min(player.maxHp, player.hp + PLAYER_DEFEND_HP_REGEN_AMOUNT);
+            player.sp = std::min(player.maxSp, player.sp + PLAYER_DEFEND_SP_REGEN_AMOUNT);
+            break;
+        case DefendResolution::SUCCESSFUL_BLOCK:
+            break;
+        case DefendResolution::HIT_THROUGH:
+        case DefendResolution::NONE:
+        default:
+            damageTaken = std::max(1, enemy.attack - player.defense);
+            player.hp -= damageTaken;
+            break;
+    }
+    player.hp = std::max(0, player.hp);
+    return damageTaken;
+}
@@ -0,0 +1,32 @@
+#ifndef COMBATRULES_H
+#define COMBATRULES_H
+
+#include "GameDataTypes.h" // Untuk PlayerStats, Enemy, DefendResolution
+#include <functional>      // Untuk std::function
+
+// Aturan pertarungan (biaya SP, jumlah hit, pengali damage, hasil bertahan) yang
+// dipakai bersama oleh GameEngine dan simulasi EnemyBalancer. Fungsi di sini hanya
+// mengubah angka; teks pertarungan tetap dicetak oleh GameEngine.
+
+// roll(bound) harus mengembalikan bilangan acak 0..bound-1.
+using CombatRoll = std::function<int(int)>;
+
+struct PlayerActionResult {
+    bool performed;                 // false jika aksi tidak dikenal atau SP tidak cukup
+    int spCost;
+    int hits;
+    int damagePerHit;
+    int totalDamage;
+    DefendResolution defendOutcome; // Hanya diisi untuk aksi bertahan ('F')
+};
+
+int getCombatActionSpCost(char action); // 0 untuk aksi tanpa biaya atau tidak dikenal
+bool isKnownCombatAction(char action);
+double expectedCombatActionDamage(char action, const PlayerStats& player, const Enemy& enemy);
+
+// Menjalankan aksi pemain: mengurangi SP pemain dan HP musuh (minimal 0).
+PlayerActionResult applyPlayerCombatAction(char action, PlayerStats& player, Enemy& enemy, const CombatRoll& roll);
+// Menjalankan serangan musuh sesuai hasil bertahan; mengembalikan damage yang diterima.
+int applyEnemyCombatTurn(DefendResolution defendOutcome, PlayerStats& player, const Enemy& enemy);
+
+#endif // COMBATRULES_H
@@ -0,0 +1,112 @@
+#include "CommandQueue.h"
+#include "GameEngine.h" // Butuh definisi GameEngine lengkap
+
+#include <cctype>    // Untuk toupper
+#include <iostream>
+#include <stdexcept> // Untuk std::runtime_error
+
+CommandQueue::CommandQueue(GameEngine& gameEngine) : gameEngine_(gameEngine) {}
+
+void CommandQueue::validate(const std::string& batch, std::vector<ParsedCommand>& commands) const {
+    const GameWorld& world = gameEngine_.getWorld();
+    std::string sceneId = gameEngine_.getCurrentSceneId();
+    const Scene* scene = world.findScene(sceneId);
+    if (!scene) throw std::runtime_error("scene saat ini tidak valid");
+    bool fightPending = gameEngine_.isInCombat() || (!scene->isEnding && !scene->enemyIdToFightOnEnter.empty());
+    commands.clear();
+    int fightGroup = -1;
+    std::string unknownActionError;
+
+    if (batch.empty()) throw std::runtime_error("batch kosong");
+    for (size_t i = 0; i < batch.size(); ++i) {
+        std::string position = "posisi " + std::to_string(i + 1);
+        if (scene->isEnding) throw std::runtime_error("batch berlanjut setelah akhir cerita di " + position);
+
+        if (batch[i] == '[') {
+            if (!fightPending) throw std::runtime_error("tidak ada pertarungan di " + position);
+            size_t close = batch.find(']', i);
+            if (close == std::string::npos) throw std::runtime_error("']' tidak ditemukan untuk " + position);
+            if (close == i + 1) throw std::runtime_error("grup aksi kosong di " + position);
+            ++fightGroup;
+            for (size_t j = i + 1; j < close; ++j) {
+                char action = static_cast<char>(toupper(static_cast<unsigned char>(batch[j])));
+                if ((action < 'A' || action > 'F') && unknownActionError.empty()) {
+                    unknownActionError = "aksi bertarung '" + std::string(1, batch[j]) + "' tidak dikenal di posisi " + std::to_string(j + 1);
+                }
+                commands.push_back({batch[j], fightGroup});
+            }
+
+            // Validasi lanjut dengan asumsi pertarungan dimenangkan.
+            auto enemy = world.getEnemyBlueprints().find(scene->enemyIdToFightOnEnter);
+            if (enemy == world.getEnemyBlueprints().end()) throw std::runtime_error("musuh tidak ditemukan di " + position);
+            sceneId = enemy->second.victorySceneId;
+            i = close;
+        } else {
+            if (fightPending) throw std::runtime_error("pertarungan harus diisi aksi [..] di " + position);
+            const SceneOption* option = scene->findOption(batch[i]);
+            if (!option) throw std::runtime_error("pilihan '" + std::string(1, batch[i]) + "' tidak ada di " + position);
+            sceneId = option->nextSceneId;
+            commands.push_back({batch[i], -1});
+        }
+
+        scene = world.findScene(sceneId);
+        if (!scene) throw std::runtime_error("scene '" + sceneId + "' tidak ditemukan");
+        fightPending = !scene->isEnding && !scene->enemyIdToFightOnEnter.empty();
+    }
+    // Satu aksi tidak dikenal tetap dijalankan dan menghanguskan giliran, seperti input
+    // satu tombol biasa; hanya batch berisi banyak perintah yang ditolak di depan.
+    if (!unknownActionError.empty() && commands.size() > 1) throw std::runtime_error(unknownActionError);
+}
+
+void CommandQueue::submit(const std::string& batch) {
+    if (!pending_.empty()) throw std::runtime_error("batch sebelumnya belum dijalankan");
+    validate(batch, parsed_);
+
+    size_t navigateCount = 0, combatCount = 0;
+    for (const ParsedCommand& parsed : parsed_) ++(parsed.fightGroup >= 0 ? combatCount : navigateCount);
+    // Pool hanya tumbuh jika batch lebih besar dari batch mana pun sebelumnya. Pool
+    // diperbesar sebelum diisi karena pending_ menyimpan pointer ke elemennya.
+    while (navigatePool_.size() < navigateCount) navigatePool_.emplace_back(gameEngine_, 'A');
+    while (combatPool_.size() < combatCount) combatPool_.emplace_back(gameEngine_, 'A');
+
+    size_t usedNavigate = 0, usedCombat = 0;
+    for (const ParsedCommand& parsed : parsed_) {
+        if (parsed.fightGroup >= 0) {
+            CombatCommand& command = combatPool_[usedCombat++];
+            command.setAction(parsed.input);
+            pending_.push_back({&command, parsed.fightGroup});
+        } else {
+            NavigateCommand& command = navigatePool_[usedNavigate++];
+            command.setChoice(parsed.input);
+            pending_.push_back({&command, -1});
+        }
+    }
+}
+
+void CommandQueue::executeAll() {
+    // Jika sudah bertarung saat batch dikirim, grup pertama melanjutkan pertarungan itu.
+    int startedGroup = gameEngine_.isInCombat() ? 0 : -1;
+    size_t executed = 0;
+    try {
+        for (; executed < pending_.size(); ++executed) {
+            const QueuedCommand& queued = pending_[executed];
+            if (gameEngine_.isPlayerDefeated()) break;
+            if (queued.fightGroup != startedGroup && gameEngine_.isInCombat()) {
+                // Aksi grup sebelumnya habis tapi musuhnya belum kalah; perintah berikutnya
+                // divalidasi untuk scene lain, jadi batch dihentikan.
+                break;
+            }
+            // Musuh grup ini sudah kalah sebelum semua aksinya terpakai; sisanya dilewati.
+            if (queued.fightGroup >= 0 && queued.fightGroup == startedGroup && !gameEngine_.isInCombat()) continue;
+            if (queued.fightGroup >= 0) startedGroup = queued.fightGroup;
+            queued.command->execute();
+        }
+    } catch (...) {
+        pending_.clear(); // Supaya submit berikutnya tidak tertolak
+        throw;
+    }
+    if (executed < pending_.size()) {
+        std::cout << "Sisa " << (pending_.size() - executed) << " perintah dalam batch dibatalkan." << std::endl;
+    }
+    pending_.clear();
+}
@@ -0,0 +1,44 @@
+#ifndef COMMANDQUEUE_H
+#define COMMANDQUEUE_H
+
+#include "MapsCommand.h" // Untuk NavigateCommand dan CombatCommand
+#include <string>
+#include <vector>
+
+class GameEngine; // Forward declaration
+
+// Antrian perintah untuk satu batch input, misalnya "ABA" atau "BAA[CC][CC]AA[CE]".
+// Huruf biasa adalah pilihan navigasi; huruf di dalam [..] adalah aksi bertarung
+// untuk satu pertarungan. Seluruh batch divalidasi ke graf scene sebelum ada yang
+// dijalankan (pertarungan dianggap menang), lalu dieksekusi tanpa menampilkan
+// scene di antaranya. Objek Command diambil dari pool yang dipakai ulang, jadi
+// tidak ada alokasi per perintah setelah pool cukup besar.
+class CommandQueue {
+public:
+    explicit CommandQueue(GameEngine& gameEngine);
+
+    void submit(const std::string& batch); // Melempar std::runtime_error jika batch tidak valid
+    void executeAll();
+    bool isEmpty() const { return pending_.empty(); }
+
+private:
+    struct ParsedCommand {
+        char input;
+        int fightGroup; // -1 untuk navigasi, selain itu indeks grup [..] di batch
+    };
+    struct QueuedCommand {
+        Command* command;
+        int fightGroup;
+    };
+
+    GameEngine& gameEngine_;
+    std::vector<NavigateCommand> navigatePool_;
+    std::vector<CombatCommand> combatPool_;
+    std::vector<ParsedCommand> parsed_; // Hasil validate(), dipakai ulang antar batch
+    std::vector<QueuedCommand> pending_;
+
+    // Satu-satunya parser batch: mengisi commands atau melempar std::runtime_error.
+    void validate(const std::string& batch, std::vector<ParsedCommand>& commands) const;
+};
+
+#endif // COMMANDQUEUE_H
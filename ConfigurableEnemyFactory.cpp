@@ -1,11 +1,13 @@
 #include "ConfigurableEnemyFactory.h"
+#include <utility> // Untuk std::move
 
-ConfigurableEnemyFactory::ConfigurableEnemyFactory(const std::map<std::string, Enemy>& blueprints)
-    : enemyBlueprints_(blueprints) {}
+ConfigurableEnemyFactory::ConfigurableEnemyFactory(std::shared_ptr<const std::map<std::string, Enemy>> blueprints)
+    : enemyBlueprints_(std::move(blueprints)) {}
 
 Enemy ConfigurableEnemyFactory::createEnemy(const std::string& enemyId) {
-    if (enemyBlueprints_.count(enemyId)) {
-        return enemyBlueprints_.at(enemyId); 
+    auto it = enemyBlueprints_->find(enemyId);
+    if (it != enemyBlueprints_->end()) {
+        return it->second; 
     }
     throw std::runtime_error("Enemy blueprint not found in factory: " + enemyId);
 }
\ No newline at end of file
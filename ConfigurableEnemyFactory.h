@@ -4,14 +4,15 @@
 #include "Interfaces.h"     // Untuk IEnemyFactory
 #include "GameDataTypes.h"  // Untuk Enemy
 #include <map>
+#include <memory>          // Untuk std::shared_ptr
 #include <string>
 #include <stdexcept>       // Untuk std::runtime_error
 
 class ConfigurableEnemyFactory : public IEnemyFactory {
 private:
-    std::map<std::string, Enemy> enemyBlueprints_; 
+    std::shared_ptr<const std::map<std::string, Enemy>> enemyBlueprints_; // Dibagi, tidak disalin
 public:
-    ConfigurableEnemyFactory(const std::map<std::string, Enemy>& blueprints);
+    ConfigurableEnemyFactory(std::shared_ptr<const std::map<std::string, Enemy>> blueprints);
     Enemy createEnemy(const std::string& enemyId) override;
 };
 
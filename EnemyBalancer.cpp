@@ -0,0 +1,242 @@
+#include "EnemyBalancer.h"
+#include "CombatRules.h"
+
+#include <algorithm> // Untuk std::max, std::any_of
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <random>    // Untuk std::minstd_rand
+#include <sstream>
+#include <stdexcept> // Untuk std::runtime_error
+#include <thread>
+
+namespace {
+
+const int MAX_SIMULATED_TURNS = 100; // Pertarungan yang lebih lama dihitung kalah (buntu)
+const unsigned int REFERENCE_RANDOM_ACTION_PERCENT = 25;
+const uint32_t POLICY_STREAM = 0; // Stream acak untuk pilihan aksi pemain referensi
+const uint32_t COMBAT_STREAM = 1; // Stream acak untuk roll pertarungan (jumlah hit, bertahan)
+
+// Seed turunan (hash splitmix32) untuk tiap (percobaan, giliran, stream).
+uint32_t deriveSeed(uint32_t trialSeed, uint32_t turn, uint32_t stream) {
+    uint32_t x = trialSeed * 0x9E3779B9u + turn * 0x85EBCA6Bu + stream * 0xC2B2AE35u;
+    x ^= x >> 16; x *= 0x7FEB352Du;
+    x ^= x >> 15; x *= 0x846CA68Bu;
+    x ^= x >> 16;
+    return x;
+}
+
+// Pemain referensi: sesekali memilih aksi acak seperti pemain manusia, selain itu
+// pakai skill dengan damage terbesar yang SP-nya cukup, dan bertahan saat HP
+// tinggal seperempat kecuali musuh bisa langsung dihabisi.
+char chooseReferenceAction(const PlayerStats& player, const Enemy& enemy, std::minstd_rand& rng) {
+    if (rng() % 100 < REFERENCE_RANDOM_ACTION_PERCENT) {
+        char action = static_cast<char>('A' + rng() % 6);
+        return (player.sp >= getCombatActionSpCost(action)) ? action : 'A';
+    }
+    char bestAction = 'A';
+    double bestDamage = expectedCombatActionDamage('A', player, enemy);
+    for (char action : {'B', 'C', 'D', 'E'}) {
+        double damage = expectedCombatActionDamage(action, player, enemy);
+        if (player.sp >= getCombatActionSpCost(action) && damage > bestDamage) {
+            bestAction = action; bestDamage = damage;
+        }
+    }
+    if (player.hp * 4 <= player.maxHp && bestDamage < enemy.hp) return 'F';
+    return bestAction;
+}
+
+// Menilai semua kandidat dengan worker sebanyak core yang tersedia; tiap worker
+// mengambil indeks kandidat berikutnya sampai habis.
+template <typename ScoreFunction>
+std::vector<double> scoreInParallel(const std::vector<Enemy>& candidates, ScoreFunction scoreOf) {
+    std::vector<double> scores(candidates.size());
+    std::atomic<size_t> nextIndex(0);
+    auto worker = [&]() {
+        for (size_t i = nextIndex++; i < candidates.size(); i = nextIndex++) scores[i] = scoreOf(candidates[i]);
+    };
+    unsigned int workerCount = std::max(1u, std::thread::hardware_concurrency());
+    workerCount = std::min<unsigned int>(workerCount, static_cast<unsigned int>(candidates.size()));
+    std::vector<std::thread> workers;
+    for (unsigned int w = 1; w < workerCount; ++w) workers.emplace_back(worker);
+    worker(); // Thread pemanggil ikut bekerja
+    for (auto& t : workers) t.join();
+    return scores;
+}
+
+} // namespace
+
+EnemyBalancer::EnemyBalancer(const PlayerStats& referencePlayer, int trialsPerCandidate, unsigned int baseSeed)
+    : referencePlayer_(referencePlayer), trialsPerCandidate_(trialsPerCandidate), baseSeed_(baseSeed) {}
+
+bool EnemyBalancer::simulateFight(Enemy enemy, PlayerStats player, uint32_t trialSeed, int& turns) const {
+    for (turns = 1; turns <= MAX_SIMULATED_TURNS; ++turns) {
+        // Pilihan aksi dan roll pertarungan punya stream sendiri, di-seed ulang tiap giliran:
+        // giliran ke-n memakai angka acak yang sama di semua kandidat, berapa pun angka
+        // yang dihabiskan giliran sebelumnya.
+        std::minstd_rand turnPolicy(deriveSeed(trialSeed, static_cast<uint32_t>(turns), POLICY_STREAM));
+        std::minstd_rand turnRolls(deriveSeed(trialSeed, static_cast<uint32_t>(turns), COMBAT_STREAM));
+        char action = chooseReferenceAction(player, enemy, turnPolicy);
+        PlayerActionResult result = applyPlayerCombatAction(action, player, enemy,
+                                                            [&turnRolls](int bound) { return static_cast<int>(turnRolls() % bound); });
+        if (enemy.hp <= 0) return true;
+        applyEnemyCombatTurn(result.defendOutcome, player, enemy);
+        if (player.hp <= 0) return false;
+    }
+    turns = MAX_SIMULATED_TURNS;
+    return false;
+}
+
+EnemyBalancer::Evaluation EnemyBalancer::evaluate(const Enemy& candidate, bool withLegendarySword) const {
+    PlayerStats player = referencePlayer_;
+    if (withLegendarySword) player.attack *= SOLARIS_SWORD_ATTACK_MULTIPLIER;
+
+    int wins = 0;
+    long long totalTurns = 0;
+    for (int trial = 0; trial < trialsPerCandidate_; ++trial) {
+        // Seed per percobaan sama untuk semua kandidat (common random numbers).
+        int turns = 0;
+        if (simulateFight(candidate, player, baseSeed_ + static_cast<uint32_t>(trial), turns)) ++wins;
+        totalTurns += turns;
+    }
+    return {static_cast<double>(wins) / trialsPerCandidate_,
+            static_cast<double>(totalTurns) / trialsPerCandidate_};
+}
+
+double EnemyBalancer::scoreCandidate(const Enemy& candidate, const std::vector<BalanceTarget>& targets) const {
+    double score = 0.0;
+    for (const auto& target : targets) {
+        if (target.enemyId != candidate.id) continue;
+        Evaluation result = evaluate(candidate, target.withLegendarySword);
+        // Dinormalisasi dengan toleransi: 5% win rate dan 10% panjang pertarungan.
+        double winError = (result.winRate - target.targetWinRate) / 0.05;
+        double turnError = (result.avgTurns - target.targetTurns) / (0.1 * std::max(1.0, target.targetTurns));
+        score += winError * winError + turnError * turnError;
+    }
+    return score;
+}
+
+Enemy EnemyBalancer::balanceEnemy(const Enemy& original, const std::vector<BalanceTarget>& targets) const {
+    Enemy best = original;
+    double bestScore = scoreCandidate(best, targets);
+    // Langkah awal besar supaya pencarian tidak terjebak di dataran (win rate 0% atau 100%).
+    int hpStep = std::max(1, original.maxHp / 2);
+    int attackStep = std::max(1, original.attack / 2);
+    int defenseStep = std::max(1, original.defense / 2);
+
+    for (int iteration = 0; iteration < 500; ++iteration) {
+        std::vector<Enemy> neighbours;
+        for (int dHp = -1; dHp <= 1; ++dHp) {
+            for (int dAttack = -1; dAttack <= 1; ++dAttack) {
+                for (int dDefense = -1; dDefense <= 1; ++dDefense) {
+                    if (dHp == 0 && dAttack == 0 && dDefense == 0) continue;
+                    Enemy candidate = best;
+                    candidate.maxHp = std::max(1, best.maxHp + dHp * hpStep); candidate.hp = candidate.maxHp;
+                    candidate.attack = std::max(1, best.attack + dAttack * attackStep);
+                    candidate.defense = std::max(0, best.defense + dDefense * defenseStep);
+                    neighbours.push_back(candidate);
+                }
+            }
+        }
+
+        std::vector<double> scores = scoreInParallel(neighbours, [this, &targets](const Enemy& candidate) {
+            return scoreCandidate(candidate, targets);
+        });
+
+        bool improved = false;
+        for (size_t i = 0; i < neighbours.size(); ++i) {
+            double score = scores[i];
+            if (score < bestScore) { bestScore = score; best = neighbours[i]; improved = true; }
+        }
+        if (improved) continue;
+        if (hpStep == 1 && attackStep == 1 && defenseStep == 1) break;
+        hpStep = std::max(1, hpStep / 2);
+        attackStep = std::max(1, attackStep / 2);
+        defenseStep = std::max(1, defenseStep / 2);
+    }
+    return best;
+}
+
+std::map<std::string, Enemy> EnemyBalancer::balanceAll(const std::map<std::string, Enemy>& blueprints,
+                                                       const std::vector<BalanceTarget>& targets) const {
+    std::map<std::string, Enemy> tuned = blueprints;
+    for (auto& entry : tuned) {
+        bool hasTarget = std::any_of(targets.begin(), targets.end(),
+                                     [&entry](const BalanceTarget& t) { return t.enemyId == entry.first; });
+        if (!hasTarget) continue;
+        entry.second = balanceEnemy(entry.second, targets);
+        for (const auto& target : targets) {
+            if (target.enemyId != entry.first) continue;
+            Evaluation result = evaluate(entry.second, target.withLegendarySword);
+            std::cout << entry.first << (target.withLegendarySword ? " (dengan Solaris)" : " (tanpa Solaris)")
+                      << ": HP " << entry.second.maxHp << ", ATK " << entry.second.attack << ", DEF " << entry.second.defense
+                      << " -> win rate " << result.winRate << " (target " << target.targetWinRate << ")"
+                      << ", giliran " << result.avgTurns << " (target " << target.targetTurns << ")" << std::endl;
+        }
+    }
+    return tuned;
+}
+
+std::vector<BalanceTarget> EnemyBalancer::defaultTargets() {
+    return {
+        {"GOROK_01", false, 0.90, 5.0},
+        {"SHADOW_GUARD", false, 0.85, 5.0},
+        {"TWIN_BLADE_1", true, 0.90, 4.0},
+        {"TWIN_BLADE_2", true, 0.85, 4.0},
+        {"LOKI_01", true, 0.80, 7.0},
+        {"LOKI_01", false, 0.10, 12.0},
+    };
+}
+
+// Format per baris: <ENEMY_ID> <sword|nosword> <win rate> <giliran>. Baris '#' diabaikan.
+// Semua baris yang salah dilaporkan sekaligus, masing-masing dengan nomor barisnya.
+std::vector<BalanceTarget> EnemyBalancer::loadTargets(const std::string& path,
+                                                      const std::map<std::string, Enemy>& blueprints) {
+    std::ifstream in(path);
+    if (!in) throw std::runtime_error("Tidak bisa membuka file target balancing: " + path);
+
+    std::vector<BalanceTarget> targets;
+    std::string errors;
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(in, line)) {
+        ++lineNumber;
+        if (line.empty() || line[0] == '#') continue;
+        std::istringstream fields(line);
+        BalanceTarget target;
+        std::string build, extra;
+        std::string problem;
+        if (!(fields >> target.enemyId >> build >> target.targetWinRate >> target.targetTurns)) {
+            problem = "format harus <ENEMY_ID> <sword|nosword> <win rate> <giliran>";
+        } else if (fields >> extra) {
+            problem = "ada isian berlebih '" + extra + "'";
+        } else if (!blueprints.count(target.enemyId)) {
+            problem = "musuh '" + target.enemyId + "' tidak dikenal";
+        } else if (build != "sword" && build != "nosword") {
+            problem = "build harus sword atau nosword, bukan '" + build + "'";
+        } else if (target.targetWinRate < 0.0 || target.targetWinRate > 1.0) {
+            problem = "win rate harus di antara 0 dan 1";
+        } else if (target.targetTurns <= 0.0) {
+            problem = "giliran harus lebih dari 0";
+        }
+        if (!problem.empty()) {
+            errors += "\n  baris " + std::to_string(lineNumber) + ": " + problem;
+            continue;
+        }
+        target.withLegendarySword = (build == "sword");
+        targets.push_back(target);
+    }
+    if (!errors.empty()) throw std::runtime_error("File target " + path + " tidak valid:" + errors);
+    return targets;
+}
+
+void EnemyBalancer::writeBlueprints(const std::string& path, const std::map<std::string, Enemy>& blueprints) {
+    std::ofstream out(path);
+    if (!out) throw std::runtime_error("Tidak bisa menulis file blueprint: " + path);
+    out << "// Hasil EnemyBalancer - salin ke konstruktor GameWorld (GameWorld.cpp)\n";
+    for (const auto& entry : blueprints) {
+        const Enemy& e = entry.second;
+        out << "internal_loadEnemy({\"" << e.id << "\", \"" << e.name << "\", " << e.maxHp << ", " << e.maxHp << ", "
+            << e.attack << ", " << e.defense << ", \"" << e.victorySceneId << "\", \"" << e.defeatEndingTitle << "\"});\n";
+    }
+}
@@ -0,0 +1,49 @@
+#ifndef ENEMYBALANCER_H
+#define ENEMYBALANCER_H
+
+#include "GameDataTypes.h" // Untuk Enemy dan PlayerStats
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+// Target desainer untuk satu musuh melawan satu build pemain.
+struct BalanceTarget {
+    std::string enemyId;
+    bool withLegendarySword; // true = attack pemain dikali SOLARIS_SWORD_ATTACK_MULTIPLIER
+    double targetWinRate;    // Peluang menang pemain (0.0 - 1.0)
+    double targetTurns;      // Rata-rata giliran pemain per pertarungan
+};
+
+// Mencari hp/attack/defense musuh yang paling dekat dengan target lewat simulasi
+// pertarungan. Semua kandidat memakai seed percobaan yang sama (common random
+// numbers) sehingga selisih antar kandidat tidak tertutup noise. Kandidat dinilai
+// paralel oleh worker sebanyak std::thread::hardware_concurrency().
+class EnemyBalancer {
+public:
+    EnemyBalancer(const PlayerStats& referencePlayer, int trialsPerCandidate = 2000, unsigned int baseSeed = 12345);
+
+    Enemy balanceEnemy(const Enemy& original, const std::vector<BalanceTarget>& targets) const;
+    std::map<std::string, Enemy> balanceAll(const std::map<std::string, Enemy>& blueprints,
+                                            const std::vector<BalanceTarget>& targets) const;
+
+    static std::vector<BalanceTarget> defaultTargets();
+    static std::vector<BalanceTarget> loadTargets(const std::string& path, const std::map<std::string, Enemy>& blueprints);
+    static void writeBlueprints(const std::string& path, const std::map<std::string, Enemy>& blueprints);
+
+private:
+    struct Evaluation {
+        double winRate;
+        double avgTurns;
+    };
+
+    PlayerStats referencePlayer_;
+    int trialsPerCandidate_;
+    unsigned int baseSeed_;
+
+    Evaluation evaluate(const Enemy& candidate, bool withLegendarySword) const;
+    double scoreCandidate(const Enemy& candidate, const std::vector<BalanceTarget>& targets) const;
+    bool simulateFight(Enemy enemy, PlayerStats player, uint32_t trialSeed, int& turns) const;
+};
+
+#endif // ENEMYBALANCER_H
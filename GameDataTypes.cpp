@@ -1,4 +1,5 @@
 #include "GameDataTypes.h"
+#include <cctype>  // Untuk toupper
 #include <utility> // Untuk std::move
 
 SceneOption::SceneOption(std::string text, std::string nextId) 
@@ -17,4 +18,13 @@ void Scene::addOption(const std::string& optionChar, const std::string& optionDe
     } else {
         options.emplace_back(optionChar + ". " + optionDesc, this->sceneId + nextSceneIdSuffixOrFullId);
     }
-}
\ No newline at end of file
+}
+const SceneOption* Scene::findOption(char choice) const {
+    char upperChoice = static_cast<char>(toupper(static_cast<unsigned char>(choice)));
+    for (const auto& opt : options) {
+        if (!opt.optionText.empty() && static_cast<char>(toupper(static_cast<unsigned char>(opt.optionText[0]))) == upperChoice) {
+            return &opt;
+        }
+    }
+    return nullptr;
+}
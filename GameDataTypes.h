@@ -1,6 +1,7 @@
 #ifndef GAMEDATATYPES_H
 #define GAMEDATATYPES_H
 
+#include <cstdint> // Untuk uint32_t
 #include <string>
 #include <vector>
 #include <map> // Hanya jika ada struct yang mendeklarasikan map sebagai member
@@ -8,6 +9,7 @@
 // Konstanta
 const int PLAYER_DEFEND_HP_REGEN_AMOUNT = 15;
 const int PLAYER_DEFEND_SP_REGEN_AMOUNT = 10;
+const int SOLARIS_SWORD_ATTACK_MULTIPLIER = 2;
 
 enum class DefendResolution { NONE, EVADE_REGEN, HIT_THROUGH, SUCCESSFUL_BLOCK };
 
@@ -20,6 +22,8 @@ struct PlayerStats {
     int defense;
 };
 
+const PlayerStats PLAYER_STARTING_STATS = {150, 150, 120, 120, 15, 5};
+
 struct Enemy {
     std::string id;
     std::string name;
@@ -47,6 +51,20 @@ struct Scene {
 
     Scene(std::string id = "", std::string desc = "", bool ending = false, std::string title = "", std::string enemyId = "");
     void addOption(const std::string& optionChar, const std::string& optionDesc, const std::string& nextSceneIdSuffixOrFullId, bool isFullId = false);
+    const SceneOption* findOption(char choice) const; // nullptr jika pilihan tidak ada
+};
+
+// Seluruh state GameEngine yang berubah selama satu sesi (untuk save/load).
+// Musuh yang sedang dilawan cukup disimpan id dan HP-nya; sisanya dari blueprint.
+struct SessionState {
+    PlayerStats playerStats;
+    std::string currentSceneId;
+    bool inCombat;
+    bool hasLegendarySword;
+    DefendResolution defendOutcome;
+    std::string combatEnemyId;
+    int combatEnemyHp;
+    uint32_t rngState;
 };
 
 #endif // GAMEDATATYPES_H
\ No newline at end of file
@@ -2,146 +2,104 @@
 #include "EndingTracker.h"
 #include "ConfigurableEnemyFactory.h" // Untuk make_unique
 #include "ChoiceLoggerObserver.h"   // Untuk make_unique
-#include "MapsCommand.h"        
+#include "CommandQueue.h"
+#include "CombatRules.h"
+#include "SessionStore.h"
 #include "Interfaces.h" 
 
 #include <iostream> 
 #include <algorithm> // Untuk std::find, std::min, std::max
 #include <stdexcept> // Untuk std::runtime_error
-#include <cstdlib>   // Untuk rand, srand
 #include <ctime>     // Untuk time
 #include <cctype>    // Untuk tolower, toupper
 #include <limits>    // Untuk std::numeric_limits
+#include <utility>   // Untuk std::move
 
-GameEngine::GameEngine() : 
+GameEngine::GameEngine(std::shared_ptr<const GameWorld> world) : 
+    inCombat_(false),
+    currentDefendOutcome_(DefendResolution::NONE),
+    world_(std::move(world)),
     currentSceneId_(""),                 
     running_(true),
+    inputClosed_(false),
     hasLegendarySword_(false),
-    inCombat_(false),
-    currentDefendOutcome_(DefendResolution::NONE)
+    rngState_(static_cast<uint32_t>(time(NULL)) | 1u),
+    sessionStore_(nullptr)
 {
-    srand(static_cast<unsigned int>(time(NULL))); 
+    // Factory berbagi blueprint milik world (aliasing shared_ptr), tanpa salinan per sesi.
+    enemyFactory_ = std::make_unique<ConfigurableEnemyFactory>(
+        std::shared_ptr<const std::map<std::string, Enemy>>(world_, &world_->getEnemyBlueprints()));
+    EndingTracker::getInstance().setTotalPossibleEndings(world_->getTotalEndingCount());
+    commandQueue_ = std::make_unique<CommandQueue>(*this);
     choiceObserver_ = std::make_unique<ChoiceLoggerObserver>();
     this->attach(choiceObserver_.get());
 }
 
 GameEngine::~GameEngine() = default; 
 
-void GameEngine::loadScene(const Scene& scene) {
-    scenes_[scene.sceneId] = scene;
-    if (scene.isEnding && !scene.endingTitle.empty()) {
-        allEndingTitles_.insert(scene.endingTitle);
-    }
-}
-
-void GameEngine::internal_loadEnemy(const Enemy& enemy) {
-    enemyTemplates_[enemy.id] = enemy;
-    if (!enemy.defeatEndingTitle.empty()) {
-        allEndingTitles_.insert(enemy.defeatEndingTitle);
-    }
-}
-
 void GameEngine::initializeGame() {
     hasLegendarySword_ = false;
     inCombat_ = false;
     currentDefendOutcome_ = DefendResolution::NONE;
-    scenes_.clear();
-    allEndingTitles_.clear();
-
-    enemyTemplates_.clear(); 
-    internal_loadEnemy({"GOROK_01", "Gorok si Penghancur", 80, 80, 20, 8, "1AAA", "ENDING 2: Gugur di Tangan Letnan Gorok"});
-    internal_loadEnemy({"SHADOW_GUARD", "Penjaga Bayangan", 70, 70, 18, 6, "LOKI_ENTRANCE_AFTER_GUARD", "ENDING 8: Dikalahkan Penjaga Bayangan"});
-    internal_loadEnemy({"TWIN_BLADE_1", "Assassin Twin Blade (1/2)", 90, 90, 22, 7, "FIGHT_TWIN_2_SCENE", "ENDING 9: Tewas oleh Twin Blade Duo"});
-    internal_loadEnemy({"TWIN_BLADE_2", "Assassin Twin Blade (2/2)", 90, 90, 24, 7, "POST_TWIN_BLADES_VICTORY", "ENDING 9: Tewas oleh Twin Blade Duo"});
-    internal_loadEnemy({"LOKI_01", "Raja Iblis Loki", 200, 200, 30, 10, "LOKI_VICTORY", "ENDING 7: Dikalahkan Raja Iblis Loki"});
-
-    enemyFactory_ = std::make_unique<ConfigurableEnemyFactory>(enemyTemplates_);
-
-    playerStats_ = {150, 150, 120, 120, 15, 5}; 
-
-    Scene scene1("1", "Heismay, (HP: {PLAYER_HP}, SP: {PLAYER_SP}) ksatria muda Ordo Charadrius, di depan Benteng Bayangan. Misi: Kalahkan Raja Iblis Loki. Langkah pertamamu?", false);
-    scene1.addOption("A", "Masuk gerbang utama.", "A");
-    scene1.addOption("B", "Cari jalan rahasia.", "B");
-    loadScene(scene1);
-
-    Scene scene1A("1A", "Gerbang utama terbuka. Gorok si Penghancur menghadang! 'Mangsa baru!'", false, "", "GOROK_01");
-    loadScene(scene1A);
-
-    Scene scene1B("1B", "Kau menemukan terowongan tua tersembunyi. Udara pengap keluar.", false);
-    scene1B.addOption("A", "Masuk ke terowongan.", "A"); 
-    scene1B.addOption("B", "Kembali ke gerbang utama.", "1A", true);
-    loadScene(scene1B);
-
-    Scene scene1AAA("1AAA", "Gorok terkapar kalah! Namun sebelum kau melangkah jauh, seorang Penjaga Bayangan lain muncul dari kegelapan! (HP: {PLAYER_HP}, SP: {PLAYER_SP})", false, "", "SHADOW_GUARD");
-    loadScene(scene1AAA);
-
-    Scene sceneLokiEntranceAfterGuard("LOKI_ENTRANCE_AFTER_GUARD", "Penjaga Bayangan itu pun tumbang. Jalan menuju jantung benteng kini lebih aman. (HP: {PLAYER_HP}, SP: {PLAYER_SP})", false);
-    sceneLokiEntranceAfterGuard.addOption("A", "Lanjutkan ke ruang tahta Loki!", "LOKI_ENTRANCE", true);
-    loadScene(sceneLokiEntranceAfterGuard);
-
-    Scene scene1AB("1AB", "Mencoba menyelinap, tapi Gorok waspada. 'Mau kemana?' Gelap.", true, "ENDING 1: Terlalu Ceroboh");
-    loadScene(scene1AB);
-
-    Scene scene1BA("1BA", "Terowongan membawamu ke ruang rahasia. Ada peti tua berukir.", false);
-    scene1BA.addOption("A", "Buka peti.", "A"); 
-    scene1BA.addOption("B", "Abaikan peti, cari jalan ke Loki.", "B"); 
-    loadScene(scene1BA);
-
-    Scene scene1BAA("1BAA", "Di dalam peti, Pedang Cahaya Solaris! Kekuatanmu berlipat ganda! Tiba-tiba, dua bayangan bergerak cepat ke arahmu!", false);
-    scene1BAA.addOption("A", "Hadapi mereka!", "FIGHT_TWIN_1_SCENE", true); 
-    loadScene(scene1BAA);
-
-    Scene sceneFightTwin1("FIGHT_TWIN_1_SCENE", "Assassin pertama dari duo Twin Blade menyerang dengan lincah!", false, "", "TWIN_BLADE_1");
-    loadScene(sceneFightTwin1);
-
-    Scene sceneFightTwin2("FIGHT_TWIN_2_SCENE", "Assassin pertama tumbang! Tanpa jeda, pasangannya yang lebih kuat langsung menyerang!", false, "", "TWIN_BLADE_2");
-    loadScene(sceneFightTwin2);
-
-    Scene scenePostTwins("POST_TWIN_BLADES_VICTORY", "Kedua assassin Twin Blade telah kau kalahkan! Jalanmu menuju Loki kini lebih aman. (HP: {PLAYER_HP}, SP: {PLAYER_SP})", false);
-    scenePostTwins.addOption("A", "Lanjutkan ke ruang tahta Loki!", "LOKI_ENTRANCE", true);
-    loadScene(scenePostTwins);
-
-    Scene scene1BAB("1BAB", "Kau mengabaikan peti. Sebuah tangga sempit membawamu naik.", false);
-    scene1BAB.addOption("A", "Naik tangga menuju takdir!", "LOKI_ENTRANCE", true); 
-    loadScene(scene1BAB);
-
-    Scene sceneLokiEntrance("LOKI_ENTRANCE", "Pintu besar ruang tahta Loki. Auranya gelap menekan. (HP: {PLAYER_HP}, SP: {PLAYER_SP})", false);
-    sceneLokiEntrance.addOption("A", "Masuk dan hadapi Raja Iblis!", "LOKI_CONFRONT", true);
-    loadScene(sceneLokiEntrance);
+    playerStats_ = PLAYER_STARTING_STATS;
+    currentSceneId_ = world_->getStartSceneId();
+    if (!world_->findScene(currentSceneId_)) {
+        std::cerr << "Error: Scene awal '" << currentSceneId_ << "' tidak ditemukan!" << std::endl;
+        running_ = false;
+    }
+}
 
-    Scene sceneLokiConfront("LOKI_CONFRONT", "", false, "", "LOKI_01");
-    loadScene(sceneLokiConfront);
+SessionState GameEngine::captureSession() const {
+    return {playerStats_, currentSceneId_, inCombat_, hasLegendarySword_, currentDefendOutcome_,
+            inCombat_ ? currentCombatEnemy_.id : "", inCombat_ ? currentCombatEnemy_.hp : 0, rngState_};
+}
 
-    Scene sceneLokiVictory("LOKI_VICTORY", "Raja Iblis Loki musnah! Cahaya kembali. Heismay sang pahlawan Charadrius!", true, "ENDING 3: Pahlawan Cahaya Charadrius");
-    loadScene(sceneLokiVictory);
+void GameEngine::restoreSession(const SessionState& state) {
+    if (!world_->findScene(state.currentSceneId)) {
+        throw std::runtime_error("Scene sesi tersimpan tidak ditemukan: " + state.currentSceneId);
+    }
+    if (state.inCombat) {
+        currentCombatEnemy_ = enemyFactory_->createEnemy(state.combatEnemyId);
+        currentCombatEnemy_.hp = state.combatEnemyHp;
+    }
+    playerStats_ = state.playerStats;
+    currentSceneId_ = state.currentSceneId;
+    inCombat_ = state.inCombat;
+    hasLegendarySword_ = state.hasLegendarySword;
+    currentDefendOutcome_ = state.defendOutcome;
+    rngState_ = state.rngState != 0 ? state.rngState : 1u; // xorshift tidak boleh berstate 0
+}
 
-    allEndingTitles_.insert("ENDING 1: Terlalu Ceroboh");
-    allEndingTitles_.insert("ENDING 3: Pahlawan Cahaya Charadrius");
+void GameEngine::attachSessionStore(SessionStore* store, const std::string& sessionId) {
+    sessionStore_ = store;
+    sessionId_ = sessionId;
+}
 
-    EndingTracker::getInstance().setTotalPossibleEndings(allEndingTitles_.size());
-    currentSceneId_ = "1";
-    if (scenes_.find(currentSceneId_) == scenes_.end()) {
-        std::cerr << "Error: Scene awal '" << currentSceneId_ << "' tidak ditemukan!" << std::endl;
-        running_ = false;
-    }
+// xorshift32: state-nya cukup satu angka sehingga ikut tersimpan di sesi.
+int GameEngine::nextRandom(int bound) {
+    rngState_ ^= rngState_ << 13;
+    rngState_ ^= rngState_ >> 17;
+    rngState_ ^= rngState_ << 5;
+    return static_cast<int>(rngState_ % static_cast<uint32_t>(bound));
 }
 
 void GameEngine::run() { 
     if (!running_) return;
     while (running_) {
         if (playerStats_.hp <= 0 && !inCombat_) { running_ = false; break; }
-        if (scenes_.find(currentSceneId_) == scenes_.end()) {
+        const Scene* scenePtr = world_->findScene(currentSceneId_);
+        if (!scenePtr) {
             std::cerr << "Error: currentSceneId_ ('" << currentSceneId_ << "') tidak valid!" << std::endl;
             running_ = false; break;
         }
-        const auto& currentScene = scenes_.at(currentSceneId_);
+        const Scene& currentScene = *scenePtr;
 
         if (inCombat_) {
             displayCombatInterface();
-            char combatActionInput = getCombatInput();
-            processPlayerCombatAction(combatActionInput);
-            if (currentCombatEnemy_.hp > 0 && playerStats_.hp > 0) { processEnemyTurn(); }
-            checkCombatResult();
+            std::string combatInput = getCombatInput();
+            if (!running_) break;
+            // Aksi tanpa kurung di prompt bertarung berlaku untuk pertarungan saat ini.
+            submitCommandBatch(combatInput[0] == '[' ? combatInput : "[" + combatInput + "]");
         } else {
             displayCurrentScene(); 
             if (currentScene.isEnding) {
@@ -150,34 +108,60 @@ void GameEngine::run() {
                 std::cout << "\n--- PERTARUNGAN DIMULAI! ---" << std::endl;
                 startCombat(currentScene.enemyIdToFightOnEnter);
             } else {
-                char navChoice = getStandardInput();
-                auto command = std::make_unique<NavigateCommand>(*this, navChoice); 
-                command->execute();
+                std::string input = getStandardInput();
+                if (!running_) break;
+                submitCommandBatch(input);
             }
         }
+        // Input yang ditolak tidak mengubah state, jadi save-nya dilewati oleh SessionStore.
+        if (sessionStore_ && running_) { sessionStore_->save(sessionId_, captureSession()); }
+    }
+    if (sessionStore_) {
+        // Permainan selesai; sesi tidak perlu dilanjutkan lagi. Jika input ditutup di
+        // tengah permainan, sesi disimpan supaya bisa dilanjutkan.
+        if (!inputClosed_) sessionStore_->erase(sessionId_);
+        sessionStore_->flush();
     }
     std::cout << "\nTerima kasih telah bermain!" << std::endl;
     EndingTracker::getInstance().displayUnlockedEndings();
 }
 
-void GameEngine::processNavigateChoice(char choice) { 
-    if (inCombat_ || scenes_.find(currentSceneId_) == scenes_.end()) return;
-    const auto& currentScene = scenes_.at(currentSceneId_);
-    std::string targetNextSceneId = "";
-    char upperChoice = static_cast<char>(toupper(static_cast<unsigned char>(choice)));
+void GameEngine::submitCommandBatch(const std::string& batch) {
+    try {
+        commandQueue_->submit(batch);
+        commandQueue_->executeAll();
+    } catch (const std::runtime_error& e) {
+        std::cout << "Pilihan tidak valid (" << e.what() << "). Coba lagi." << std::endl;
+    }
+}
 
-    for (const auto& opt : currentScene.options) {
-        if (!opt.optionText.empty() && static_cast<char>(toupper(static_cast<unsigned char>(opt.optionText[0]))) == upperChoice) {
-            targetNextSceneId = opt.nextSceneId; break;
-        }
+void GameEngine::processCombatChoice(char action) {
+    if (!inCombat_) {
+        const Scene* scenePtr = world_->findScene(currentSceneId_);
+        if (!scenePtr || scenePtr->enemyIdToFightOnEnter.empty()) return;
+        std::cout << "\n--- PERTARUNGAN DIMULAI! ---" << std::endl;
+        startCombat(scenePtr->enemyIdToFightOnEnter);
+        if (!inCombat_) return;
     }
+    processPlayerCombatAction(static_cast<char>(toupper(static_cast<unsigned char>(action))));
+    if (currentCombatEnemy_.hp > 0 && playerStats_.hp > 0) { processEnemyTurn(); }
+    checkCombatResult();
+}
 
-    if (!targetNextSceneId.empty() && scenes_.count(targetNextSceneId)) {
+void GameEngine::processNavigateChoice(char choice) { 
+    const Scene* scenePtr = world_->findScene(currentSceneId_);
+    if (inCombat_ || !scenePtr) return;
+    const Scene& currentScene = *scenePtr;
+    const SceneOption* option = currentScene.findOption(choice);
+    std::string targetNextSceneId = option ? option->nextSceneId : "";
+    char upperChoice = static_cast<char>(toupper(static_cast<unsigned char>(choice)));
+
+    if (!targetNextSceneId.empty() && world_->findScene(targetNextSceneId)) {
         if (currentSceneId_ == "1BA" && upperChoice == 'A' && targetNextSceneId == "1BAA") {
             if (!hasLegendarySword_) { 
                 hasLegendarySword_ = true; 
                 int oldAttack = playerStats_.attack;
-                playerStats_.attack *= 2; 
+                playerStats_.attack *= SOLARIS_SWORD_ATTACK_MULTIPLIER; 
                 std::cout << "\n*** Kamu mendapatkan Pedang Cahaya Solaris! Kekuatan seranganmu berlipat ganda dari " 
                           << oldAttack << " menjadi " << playerStats_.attack << "! ***\n";
             }
@@ -189,7 +173,7 @@ void GameEngine::processNavigateChoice(char choice) {
     }
 }
 void GameEngine::promptPlayAgain() { 
-    char playAgainChoice;
+    char playAgainChoice = 'n'; // EOF dianggap tidak
     std::cout << "\nApakah Anda ingin bermain lagi? (y/n): ";
     std::cin >> playAgainChoice;
     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
@@ -201,19 +185,21 @@ void GameEngine::promptPlayAgain() {
         running_ = false;
     }
 }
-char GameEngine::getStandardInput() { 
+std::string GameEngine::getStandardInput() { 
     std::cout << "Apa pilihanmu: -> ";
-    char choiceInput;
+    std::string choiceInput;
     std::cin >> choiceInput;
+    if (!std::cin) { running_ = false; inputClosed_ = true; return ""; } // EOF: berhenti, jangan mengulang prompt
     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
     return choiceInput;
 }
-char GameEngine::getCombatInput() { 
+std::string GameEngine::getCombatInput() { 
     std::cout << "Aksi Bertarung: -> ";
-    char choiceInput;
+    std::string choiceInput;
     std::cin >> choiceInput;
+    if (!std::cin) { running_ = false; inputClosed_ = true; return ""; } // EOF: berhenti, jangan mengulang prompt
     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-    return static_cast<char>(toupper(static_cast<unsigned char>(choiceInput)));
+    return choiceInput;
 }
 
 std::string GameEngine::replacePlaceholders(std::string text) { 
@@ -231,11 +217,12 @@ std::string GameEngine::replacePlaceholders(std::string text) {
 }
 
 void GameEngine::displayCurrentScene() {
-    if (!scenes_.count(currentSceneId_)) {
+    const Scene* scenePtr = world_->findScene(currentSceneId_);
+    if (!scenePtr) {
         std::cout << "Error: Scene '" << currentSceneId_ << "' tidak ditemukan." << std::endl;
         running_ = false; return;
     }
-    Scene sceneToDisplay = scenes_.at(currentSceneId_); 
+    const Scene& sceneToDisplay = *scenePtr; 
     std::string finalDescription = sceneToDisplay.description;
     if (currentSceneId_ == "LOKI_CONFRONT") {
         if (hasLegendarySword_) {
@@ -299,104 +286,69 @@ void GameEngine::displayCombatInterface() {
 }
 
 void GameEngine::processPlayerCombatAction(char action) { 
-    int spCost = 0;
-    currentDefendOutcome_ = DefendResolution::NONE;
+    PlayerActionResult result = applyPlayerCombatAction(action, playerStats_, currentCombatEnemy_,
+                                                        [this](int bound) { return nextRandom(bound); });
+    currentDefendOutcome_ = result.defendOutcome;
+
+    const char* skillName = "";
+    switch (action) {
+        case 'B': skillName = "Rising Slash"; break;
+        case 'C': skillName = "Sword Dance"; break;
+        case 'D': skillName = "Shining Arrow"; break;
+        case 'E': skillName = "Samsara"; break;
+    }
+    if (!isKnownCombatAction(action)) {
+        std::cout << "Aksi tidak dikenal. Heismay ragu-ragu dan kehilangan giliran." << std::endl;
+        return;
+    }
+    if (!result.performed) {
+        std::cout << "SP tidak cukup untuk " << skillName << "!" << std::endl;
+        return;
+    }
 
     switch (action) {
         case 'A': 
             std::cout << "Heismay melakukan serangan biasa!" << std::endl;
-            {
-                int damageDealt = std::max(1, playerStats_.attack - currentCombatEnemy_.defense);
-                currentCombatEnemy_.hp -= damageDealt; currentCombatEnemy_.hp = std::max(0, currentCombatEnemy_.hp);
-                std::cout << "Memberikan " << damageDealt << " damage fisik." << std::endl;
-            }
+            std::cout << "Memberikan " << result.totalDamage << " damage fisik." << std::endl;
             break;
         case 'B': 
-            spCost = 15;
-            if (playerStats_.sp >= spCost) {
-                playerStats_.sp -= spCost; std::cout << "Heismay menggunakan Rising Slash! (SP Sisa: " << playerStats_.sp << ")" << std::endl;
-                int roll_hits = rand() % 100; int hits = (roll_hits < 30) ? 5 : (roll_hits < 90) ? 4 : 3;
-                int totalDamage = 0; float damagePerHitMultiplier = 0.4f;
-                std::cout << "Menyerang " << hits << " kali:" << std::endl;
-                for (int i = 0; i < hits; ++i) {
-                    int damageThisHit = std::max(1, static_cast<int>(playerStats_.attack * damagePerHitMultiplier) - currentCombatEnemy_.defense);
-                    currentCombatEnemy_.hp -= damageThisHit; totalDamage += damageThisHit;
-                    std::cout << "  Hit " << (i + 1) << ": " << damageThisHit << " damage." << std::endl;
-                }
-                currentCombatEnemy_.hp = std::max(0, currentCombatEnemy_.hp);
-                std::cout << "Total damage Rising Slash: " << totalDamage << " fisik." << std::endl;
-            } else { std::cout << "SP tidak cukup untuk Rising Slash!" << std::endl; }
-            break;
         case 'C': 
-            spCost = 40;
-            if (playerStats_.sp >= spCost) {
-                playerStats_.sp -= spCost; std::cout << "Heismay menggunakan Sword Dance! (SP Sisa: " << playerStats_.sp << ")" << std::endl;
-                int hits = 8; int totalDamage = 0; float damagePerHitMultiplier = 0.8f;
-                 std::cout << "Menyerang " << hits << " kali:" << std::endl;
-                for (int i = 0; i < hits; ++i) {
-                    int damageThisHit = std::max(1, static_cast<int>(playerStats_.attack * damagePerHitMultiplier) - currentCombatEnemy_.defense);
-                    currentCombatEnemy_.hp -= damageThisHit; totalDamage += damageThisHit;
-                    std::cout << "  Hit " << (i + 1) << ": " << damageThisHit << " damage." << std::endl;
-                }
-                currentCombatEnemy_.hp = std::max(0, currentCombatEnemy_.hp);
-                std::cout << "Total damage Sword Dance: " << totalDamage << " fisik." << std::endl;
-            } else { std::cout << "SP tidak cukup untuk Sword Dance!" << std::endl; }
+            std::cout << "Heismay menggunakan " << skillName << "! (SP Sisa: " << playerStats_.sp << ")" << std::endl;
+            std::cout << "Menyerang " << result.hits << " kali:" << std::endl;
+            for (int i = 0; i < result.hits; ++i) {
+                std::cout << "  Hit " << (i + 1) << ": " << result.damagePerHit << " damage." << std::endl;
+            }
+            std::cout << "Total damage " << skillName << ": " << result.totalDamage << " fisik." << std::endl;
             break;
         case 'D': 
-            spCost = 30;
-            if (playerStats_.sp >= spCost) {
-                playerStats_.sp -= spCost; std::cout << "Heismay merapal Shining Arrow! (SP Sisa: " << playerStats_.sp << ")" << std::endl;
-                int hits = (rand() % 5) + 4; int totalDamage = 0; float damagePerHitMultiplier = 0.6f;
-                std::cout << "Panah cahaya menghujani musuh " << hits << " kali:" << std::endl;
-                for (int i = 0; i < hits; ++i) {
-                    int damageThisHit = std::max(1, static_cast<int>(playerStats_.attack * damagePerHitMultiplier) - currentCombatEnemy_.defense);
-                    currentCombatEnemy_.hp -= damageThisHit; totalDamage += damageThisHit;
-                    std::cout << "  Panah " << (i + 1) << ": " << damageThisHit << " damage cahaya." << std::endl;
-                }
-                currentCombatEnemy_.hp = std::max(0, currentCombatEnemy_.hp);
-                std::cout << "Total damage Shining Arrow: " << totalDamage << " cahaya." << std::endl;
-            } else { std::cout << "SP tidak cukup untuk Shining Arrow!" << std::endl; }
+            std::cout << "Heismay merapal Shining Arrow! (SP Sisa: " << playerStats_.sp << ")" << std::endl;
+            std::cout << "Panah cahaya menghujani musuh " << result.hits << " kali:" << std::endl;
+            for (int i = 0; i < result.hits; ++i) {
+                std::cout << "  Panah " << (i + 1) << ": " << result.damagePerHit << " damage cahaya." << std::endl;
+            }
+            std::cout << "Total damage Shining Arrow: " << result.totalDamage << " cahaya." << std::endl;
             break;
         case 'E': 
-            spCost = 60;
-            if (playerStats_.sp >= spCost) {
-                playerStats_.sp -= spCost; std::cout << "Heismay melepaskan kekuatan Samsara! (SP Sisa: " << playerStats_.sp << ")" << std::endl;
-                float damageMultiplier = 2.5f;
-                int damageDealt = std::max(1, static_cast<int>(playerStats_.attack * damageMultiplier) - currentCombatEnemy_.defense);
-                currentCombatEnemy_.hp -= damageDealt; currentCombatEnemy_.hp = std::max(0, currentCombatEnemy_.hp);
-                std::cout << "Samsara memberikan " << damageDealt << " damage cahaya besar." << std::endl;
-            } else { std::cout << "SP tidak cukup untuk Samsara!" << std::endl; }
+            std::cout << "Heismay melepaskan kekuatan Samsara! (SP Sisa: " << playerStats_.sp << ")" << std::endl;
+            std::cout << "Samsara memberikan " << result.totalDamage << " damage cahaya besar." << std::endl;
             break;
         case 'F': 
             std::cout << "Heismay mengambil posisi bertahan..." << std::endl;
-            { 
-                int roll = rand() % 100; 
-                if (roll < 50) { currentDefendOutcome_ = DefendResolution::EVADE_REGEN; } 
-                else if (roll < 65) { currentDefendOutcome_ = DefendResolution::HIT_THROUGH; } 
-                else { currentDefendOutcome_ = DefendResolution::SUCCESSFUL_BLOCK; }
-            }
-            break;
-        default:
-            std::cout << "Aksi tidak dikenal. Heismay ragu-ragu dan kehilangan giliran." << std::endl;
             break;
     }
 }
 
 void GameEngine::processEnemyTurn() { 
     std::cout << currentCombatEnemy_.name << " menyerang Heismay!" << std::endl;
-    int damageTaken = 0; 
+    int damageTaken = applyEnemyCombatTurn(currentDefendOutcome_, playerStats_, currentCombatEnemy_);
 
     switch (currentDefendOutcome_) {
         case DefendResolution::EVADE_REGEN:
-            playerStats_.hp = std::min(playerStats_.maxHp, playerStats_.hp + PLAYER_DEFEND_HP_REGEN_AMOUNT);
-            playerStats_.sp = std::min(playerStats_.maxSp, playerStats_.sp + PLAYER_DEFEND_SP_REGEN_AMOUNT);
             std::cout << "Serangan musuh meleset! Heismay menghindar, memulihkan " 
                       << PLAYER_DEFEND_HP_REGEN_AMOUNT << " HP dan " 
                       << PLAYER_DEFEND_SP_REGEN_AMOUNT << " SP!" << std::endl;
             break;
         case DefendResolution::HIT_THROUGH:
-            damageTaken = std::max(1, currentCombatEnemy_.attack - playerStats_.defense);
-            playerStats_.hp -= damageTaken;
             std::cout << "Heismay mencoba bertahan, tapi serangan " << currentCombatEnemy_.name 
                       << " berhasil menembus, memberikan " << damageTaken << " damage!" << std::endl;
             break;
@@ -405,12 +357,9 @@ void GameEngine::processEnemyTurn() {
             break;
         case DefendResolution::NONE: 
         default:
-            damageTaken = std::max(1, currentCombatEnemy_.attack - playerStats_.defense);
-            playerStats_.hp -= damageTaken;
             std::cout << currentCombatEnemy_.name << " memberikan " << damageTaken << " damage kepada Heismay." << std::endl;
             break;
     }
-    playerStats_.hp = std::max(0, playerStats_.hp); 
     currentDefendOutcome_ = DefendResolution::NONE;
 }
 
@@ -6,23 +6,34 @@
 #include <string>
 #include <vector>
 #include <map>
-#include <set>
-#include <memory>       // Untuk std::unique_ptr
+#include <memory>       // Untuk std::unique_ptr, std::shared_ptr
 #include "GameDataTypes.h"
+#include "GameWorld.h"
 #include "Interfaces.h"    // Untuk Subject dan IEnemyFactory (jika IEnemyFactory adalah base)
 
 // ---- FORWARD DECLARATIONS ----
 class ChoiceLoggerObserver; 
+class SessionStore;
+class CommandQueue;
 // class IEnemyFactory; // Tidak perlu jika sudah diinclude dari Interfaces.h dan Interfaces.h tidak include GameEngine.h secara sirkular
 
 class GameEngine : public Subject {
 public:
-    GameEngine();
+    explicit GameEngine(std::shared_ptr<const GameWorld> world = GameWorld::getShared());
     ~GameEngine(); // <--- DEKLARASI DESTRUCTOR DI SINI (PENTING!)
 
     void initializeGame();
     void run();
     void processNavigateChoice(char choice);
+    void processCombatChoice(char action); // Memulai pertarungan scene jika belum dimulai
+    const GameWorld& getWorld() const { return *world_; }
+    const std::string& getCurrentSceneId() const { return currentSceneId_; }
+    bool isInCombat() const { return inCombat_; }
+    bool isPlayerDefeated() const { return playerStats_.hp <= 0; }
+
+    SessionState captureSession() const;
+    void restoreSession(const SessionState& state);
+    void attachSessionStore(SessionStore* store, const std::string& sessionId);
 
 private:
     PlayerStats playerStats_;
@@ -30,24 +41,28 @@ private:
     bool inCombat_;
     DefendResolution currentDefendOutcome_; 
 
-    std::map<std::string, Scene> scenes_;
-    std::map<std::string, Enemy> enemyTemplates_; 
+    std::shared_ptr<const GameWorld> world_;
     std::unique_ptr<IEnemyFactory> enemyFactory_; 
+    std::unique_ptr<CommandQueue> commandQueue_;
     std::unique_ptr<ChoiceLoggerObserver> choiceObserver_; // <--- unique_ptr ini yang jadi masalah
 
     std::string currentSceneId_;
     bool running_;
+    bool inputClosed_; // stdin habis (EOF) sebelum permainan selesai
     // std::unique_ptr<ChoiceLoggerObserver> choiceObserver_; // Sudah di atas
-    std::set<std::string> allEndingTitles_;
     bool hasLegendarySword_;
+    uint32_t rngState_;
+
+    SessionStore* sessionStore_; // Tidak dimiliki; nullptr jika sesi tidak disimpan
+    std::string sessionId_;
 
     // Deklarasi metode private
-    void loadScene(const Scene& scene);
-    void internal_loadEnemy(const Enemy& enemy);
     // ... (sisa deklarasi metode private Anda)
+    int nextRandom(int bound);
     void promptPlayAgain();
-    char getStandardInput();
-    char getCombatInput();
+    void submitCommandBatch(const std::string& batch);
+    std::string getStandardInput();
+    std::string getCombatInput();
     std::string replacePlaceholders(std::string text);
     void displayCurrentScene();
     void handleEnding(const std::string& endingTitleToRecord);
@@ -0,0 +1,93 @@
+#include "GameWorld.h"
+
+GameWorld::GameWorld() : startSceneId_("1") {
+    internal_loadEnemy({"GOROK_01", "Gorok si Penghancur", 80, 80, 20, 8, "1AAA", "ENDING 2: Gugur di Tangan Letnan Gorok"});
+    internal_loadEnemy({"SHADOW_GUARD", "Penjaga Bayangan", 70, 70, 18, 6, "LOKI_ENTRANCE_AFTER_GUARD", "ENDING 8: Dikalahkan Penjaga Bayangan"});
+    internal_loadEnemy({"TWIN_BLADE_1", "Assassin Twin Blade (1/2)", 90, 90, 22, 7, "FIGHT_TWIN_2_SCENE", "ENDING 9: Tewas oleh Twin Blade Duo"});
+    internal_loadEnemy({"TWIN_BLADE_2", "Assassin Twin Blade (2/2)", 90, 90, 24, 7, "POST_TWIN_BLADES_VICTORY", "ENDING 9: Tewas oleh Twin Blade Duo"});
+    internal_loadEnemy({"LOKI_01", "Raja Iblis Loki", 200, 200, 30, 10, "LOKI_VICTORY", "ENDING 7: Dikalahkan Raja Iblis Loki"});
+
+    Scene scene1("1", "Heismay, (HP: {PLAYER_HP}, SP: {PLAYER_SP}) ksatria muda Ordo Charadrius, di depan Benteng Bayangan. Misi: Kalahkan Raja Iblis Loki. Langkah pertamamu?", false);
+    scene1.addOption("A", "Masuk gerbang utama.", "A");
+    scene1.addOption("B", "Cari jalan rahasia.", "B");
+    loadScene(scene1);
+
+    Scene scene1A("1A", "Gerbang utama terbuka. Gorok si Penghancur menghadang! 'Mangsa baru!'", false, "", "GOROK_01");
+    loadScene(scene1A);
+
+    Scene scene1B("1B", "Kau menemukan terowongan tua tersembunyi. Udara pengap keluar.", false);
+    scene1B.addOption("A", "Masuk ke terowongan.", "A"); 
+    scene1B.addOption("B", "Kembali ke gerbang utama.", "1A", true);
+    loadScene(scene1B);
+
+    Scene scene1AAA("1AAA", "Gorok terkapar kalah! Namun sebelum kau melangkah jauh, seorang Penjaga Bayangan lain muncul dari kegelapan! (HP: {PLAYER_HP}, SP: {PLAYER_SP})", false, "", "SHADOW_GUARD");
+    loadScene(scene1AAA);
+
+    Scene sceneLokiEntranceAfterGuard("LOKI_ENTRANCE_AFTER_GUARD", "Penjaga Bayangan itu pun tumbang. Jalan menuju jantung benteng kini lebih aman. (HP: {PLAYER_HP}, SP: {PLAYER_SP})", false);
+    sceneLokiEntranceAfterGuard.addOption("A", "Lanjutkan ke ruang tahta Loki!", "LOKI_ENTRANCE", true);
+    loadScene(sceneLokiEntranceAfterGuard);
+
+    Scene scene1AB("1AB", "Mencoba menyelinap, tapi Gorok waspada. 'Mau kemana?' Gelap.", true, "ENDING 1: Terlalu Ceroboh");
+    loadScene(scene1AB);
+
+    Scene scene1BA("1BA", "Terowongan membawamu ke ruang rahasia. Ada peti tua berukir.", false);
+    scene1BA.addOption("A", "Buka peti.", "A"); 
+    scene1BA.addOption("B", "Abaikan peti, cari jalan ke Loki.", "B"); 
+    loadScene(scene1BA);
+
+    Scene scene1BAA("1BAA", "Di dalam peti, Pedang Cahaya Solaris! Kekuatanmu berlipat ganda! Tiba-tiba, dua bayangan bergerak cepat ke arahmu!", false);
+    scene1BAA.addOption("A", "Hadapi mereka!", "FIGHT_TWIN_1_SCENE", true); 
+    loadScene(scene1BAA);
+
+    Scene sceneFightTwin1("FIGHT_TWIN_1_SCENE", "Assassin pertama dari duo Twin Blade menyerang dengan lincah!", false, "", "TWIN_BLADE_1");
+    loadScene(sceneFightTwin1);
+
+    Scene sceneFightTwin2("FIGHT_TWIN_2_SCENE", "Assassin pertama tumbang! Tanpa jeda, pasangannya yang lebih kuat langsung menyerang!", false, "", "TWIN_BLADE_2");
+    loadScene(sceneFightTwin2);
+
+    Scene scenePostTwins("POST_TWIN_BLADES_VICTORY", "Kedua assassin Twin Blade telah kau kalahkan! Jalanmu menuju Loki kini lebih aman. (HP: {PLAYER_HP}, SP: {PLAYER_SP})", false);
+    scenePostTwins.addOption("A", "Lanjutkan ke ruang tahta Loki!", "LOKI_ENTRANCE", true);
+    loadScene(scenePostTwins);
+
+    Scene scene1BAB("1BAB", "Kau mengabaikan peti. Sebuah tangga sempit membawamu naik.", false);
+    scene1BAB.addOption("A", "Naik tangga menuju takdir!", "LOKI_ENTRANCE", true); 
+    loadScene(scene1BAB);
+
+    Scene sceneLokiEntrance("LOKI_ENTRANCE", "Pintu besar ruang tahta Loki. Auranya gelap menekan. (HP: {PLAYER_HP}, SP: {PLAYER_SP})", false);
+    sceneLokiEntrance.addOption("A", "Masuk dan hadapi Raja Iblis!", "LOKI_CONFRONT", true);
+    loadScene(sceneLokiEntrance);
+
+    Scene sceneLokiConfront("LOKI_CONFRONT", "", false, "", "LOKI_01");
+    loadScene(sceneLokiConfront);
+
+    Scene sceneLokiVictory("LOKI_VICTORY", "Raja Iblis Loki musnah! Cahaya kembali. Heismay sang pahlawan Charadrius!", true, "ENDING 3: Pahlawan Cahaya Charadrius");
+    loadScene(sceneLokiVictory);
+
+    allEndingTitles_.insert("ENDING 1: Terlalu Ceroboh");
+    allEndingTitles_.insert("ENDING 3: Pahlawan Cahaya Charadrius");
+}
+
+std::shared_ptr<const GameWorld> GameWorld::getShared() {
+    // Dibangun sekali per proses; inisialisasi static lokal aman untuk multi-thread.
+    static const std::shared_ptr<const GameWorld> instance(new GameWorld());
+    return instance;
+}
+
+void GameWorld::loadScene(const Scene& scene) {
+    scenes_[scene.sceneId] = scene;
+    if (scene.isEnding && !scene.endingTitle.empty()) {
+        allEndingTitles_.insert(scene.endingTitle);
+    }
+}
+
+void GameWorld::internal_loadEnemy(const Enemy& enemy) {
+    enemyBlueprints_[enemy.id] = enemy;
+    if (!enemy.defeatEndingTitle.empty()) {
+        allEndingTitles_.insert(enemy.defeatEndingTitle);
+    }
+}
+
+const Scene* GameWorld::findScene(const std::string& sceneId) const {
+    auto it = scenes_.find(sceneId);
+    return it != scenes_.end() ? &it->second : nullptr;
+}
@@ -0,0 +1,35 @@
+#ifndef GAMEWORLD_H
+#define GAMEWORLD_H
+
+#include "GameDataTypes.h" // Untuk Scene dan Enemy
+#include <map>
+#include <memory>          // Untuk std::shared_ptr
+#include <set>
+#include <string>
+
+// Konten permainan (scene dan blueprint musuh) yang tidak berubah. Dibangun sekali
+// per proses lalu dibagi ke semua GameEngine lewat shared_ptr; state per sesi
+// tetap ada di GameEngine sehingga "main lagi" tidak perlu membangun ulang dunia.
+class GameWorld {
+public:
+    static std::shared_ptr<const GameWorld> getShared();
+    GameWorld(const GameWorld&) = delete;
+    void operator=(const GameWorld&) = delete;
+
+    const Scene* findScene(const std::string& sceneId) const; // nullptr jika tidak ada
+    const std::map<std::string, Enemy>& getEnemyBlueprints() const { return enemyBlueprints_; }
+    const std::string& getStartSceneId() const { return startSceneId_; }
+    int getTotalEndingCount() const { return static_cast<int>(allEndingTitles_.size()); }
+
+private:
+    GameWorld();
+    void loadScene(const Scene& scene);
+    void internal_loadEnemy(const Enemy& enemy);
+
+    std::map<std::string, Scene> scenes_;
+    std::map<std::string, Enemy> enemyBlueprints_;
+    std::set<std::string> allEndingTitles_;
+    std::string startSceneId_;
+};
+
+#endif // GAMEWORLD_H
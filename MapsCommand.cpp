@@ -6,4 +6,11 @@ NavigateCommand::NavigateCommand(GameEngine& gameEngine, char choice)
 
 void NavigateCommand::execute() { 
     gameEngine_.processNavigateChoice(choice_); 
+}
+
+CombatCommand::CombatCommand(GameEngine& gameEngine, char action)
+    : gameEngine_(gameEngine), action_(action) {}
+
+void CombatCommand::execute() { 
+    gameEngine_.processCombatChoice(action_); 
 }
\ No newline at end of file
@@ -10,9 +10,20 @@ class NavigateCommand : public Command {
 public:
     NavigateCommand(GameEngine& gameEngine, char choice);
     void execute() override;
+    void setChoice(char choice) { choice_ = choice; } // Untuk dipakai ulang dari pool CommandQueue
 private:
     GameEngine& gameEngine_; 
     char choice_;
 };
 
+class CombatCommand : public Command {
+public:
+    CombatCommand(GameEngine& gameEngine, char action);
+    void execute() override;
+    void setAction(char action) { action_ = action; }
+private:
+    GameEngine& gameEngine_; 
+    char action_;
+};
+
 #endif // NAVIGATECOMMAND_H
\ No newline at end of file
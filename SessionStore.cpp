@@ -0,0 +1,349 @@
+#include "SessionStore.h"
+
+#include <array>
+#include <filesystem> // Untuk rename dan resize_file
+#include <fstream>
+#include <stdexcept>  // Untuk std::runtime_error
+
+#include <fcntl.h>    // Untuk open / _open
+
+#ifdef _WIN32
+#include <io.h>       // Untuk _commit, _fileno, _locking
+#include <sys/locking.h>
+#include <sys/stat.h>
+#else
+#include <sys/file.h> // Untuk flock
+#include <unistd.h>   // Untuk fsync, fileno, close
+#endif
+
+namespace {
+
+const uint32_t RECORD_MAGIC = 0x48534731; // "HSG1"
+const uint8_t SESSION_FORMAT_VERSION = 1;
+const size_t RECORD_HEADER_SIZE = 4 + 2 + 4; // magic + panjang id + panjang payload
+const size_t RECORD_CRC_SIZE = 4;
+
+uint32_t crc32(const uint8_t* data, size_t length) {
+    static const std::array<uint32_t, 256> table = [] {
+        std::array<uint32_t, 256> t{};
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            t[i] = c;
+        }
+        return t;
+    }();
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < length; ++i) crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return crc ^ 0xFFFFFFFFu;
+}
+
+void putU16(std::vector<uint8_t>& out, uint16_t v) {
+    out.push_back(static_cast<uint8_t>(v)); out.push_back(static_cast<uint8_t>(v >> 8));
+}
+void putU32(std::vector<uint8_t>& out, uint32_t v) {
+    for (int shift = 0; shift < 32; shift += 8) out.push_back(static_cast<uint8_t>(v >> shift));
+}
+void putString(std::vector<uint8_t>& out, const std::string& s) {
+    putU16(out, static_cast<uint16_t>(s.size()));
+    out.insert(out.end(), s.begin(), s.end());
+}
+
+uint16_t readU16(const uint8_t* p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+uint32_t readU32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+// Pembaca payload dengan pengecekan batas; ok_ jadi false jika data kurang.
+class PayloadReader {
+public:
+    explicit PayloadReader(const std::vector<uint8_t>& data) : data_(data), pos_(0), ok_(true) {}
+    uint8_t u8() { return has(1) ? data_[pos_++] : 0; }
+    uint32_t u32() {
+        if (!has(4)) return 0;
+        uint32_t v = readU32(&data_[pos_]); pos_ += 4; return v;
+    }
+    int i32() { return static_cast<int>(u32()); }
+    std::string str() {
+        if (!has(2)) return "";
+        uint16_t length = readU16(&data_[pos_]); pos_ += 2;
+        if (!has(length)) return "";
+        std::string s(data_.begin() + pos_, data_.begin() + pos_ + length); pos_ += length; return s;
+    }
+    bool ok() const { return ok_ && pos_ == data_.size(); }
+private:
+    bool has(size_t n) { if (pos_ + n > data_.size()) ok_ = false; return ok_; }
+    const std::vector<uint8_t>& data_;
+    size_t pos_;
+    bool ok_;
+};
+
+void appendFrame(std::vector<uint8_t>& out, const std::string& sessionId, const std::vector<uint8_t>& payload) {
+    size_t start = out.size();
+    putU32(out, RECORD_MAGIC);
+    putU16(out, static_cast<uint16_t>(sessionId.size()));
+    putU32(out, static_cast<uint32_t>(payload.size()));
+    out.insert(out.end(), sessionId.begin(), sessionId.end());
+    out.insert(out.end(), payload.begin(), payload.end());
+    putU32(out, crc32(&out[start + 4], out.size() - start - 4));
+}
+
+// Memutar ulang record berurutan ke map; berhenti di record pertama yang rusak.
+// Mengembalikan jumlah byte yang valid. Payload kosong berarti sesi dihapus.
+size_t replayRecords(const std::vector<uint8_t>& data,
+                     std::unordered_map<std::string, std::vector<uint8_t>>& records) {
+    size_t pos = 0;
+    while (data.size() - pos >= RECORD_HEADER_SIZE + RECORD_CRC_SIZE) {
+        const uint8_t* header = &data[pos];
+        if (readU32(header) != RECORD_MAGIC) break;
+        size_t idLength = readU16(header + 4);
+        size_t payloadLength = readU32(header + 6);
+        size_t recordSize = RECORD_HEADER_SIZE + idLength + payloadLength + RECORD_CRC_SIZE;
+        if (data.size() - pos < recordSize) break;
+        size_t crcOffset = pos + recordSize - RECORD_CRC_SIZE;
+        if (crc32(header + 4, crcOffset - pos - 4) != readU32(&data[crcOffset])) break;
+
+        const uint8_t* body = header + RECORD_HEADER_SIZE;
+        std::string sessionId(body, body + idLength);
+        if (payloadLength == 0) { records.erase(sessionId); }
+        else { records[sessionId].assign(body + idLength, body + idLength + payloadLength); }
+        pos += recordSize;
+    }
+    return pos;
+}
+
+std::vector<uint8_t> readWholeFile(const std::string& path) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) return {};
+    std::vector<uint8_t> data(static_cast<size_t>(in.tellg()));
+    in.seekg(0);
+    in.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    return data;
+}
+
+void writeAndSync(FILE* file, const std::vector<uint8_t>& data, const std::string& path) {
+    if (fwrite(data.data(), 1, data.size(), file) != data.size() || fflush(file) != 0) {
+        throw std::runtime_error("Gagal menulis file sesi: " + path);
+    }
+#ifdef _WIN32
+    bool synced = _commit(_fileno(file)) == 0;
+#else
+    bool synced = fsync(fileno(file)) == 0;
+#endif
+    if (!synced) throw std::runtime_error("Gagal menyinkronkan file sesi ke disk: " + path);
+}
+
+// Di POSIX, rename baru tahan crash setelah direktori induknya ikut di-fsync.
+// Windows tidak punya padanan untuk direktori, jadi dilewati.
+void syncParentDirectory(const std::string& path) {
+#ifndef _WIN32
+    std::filesystem::path parent = std::filesystem::path(path).parent_path();
+    std::string directory = parent.empty() ? "." : parent.string();
+    int fd = open(directory.c_str(), O_RDONLY);
+    bool synced = fd >= 0 && fsync(fd) == 0;
+    if (fd >= 0) close(fd);
+    if (!synced) throw std::runtime_error("Gagal menyinkronkan direktori sesi: " + directory);
+#else
+    (void)path;
+#endif
+}
+
+} // namespace
+
+SessionStore::SessionStore(const std::string& basePath, size_t batchSize, size_t compactThresholdBytes)
+    : snapshotPath_(basePath + ".snapshot"),
+      journalPath_(basePath + ".journal"),
+      lockPath_(basePath + ".lock"),
+      lockFd_(-1),
+      batchSize_(batchSize == 0 ? 1 : batchSize),
+      compactThresholdBytes_(compactThresholdBytes),
+      pendingCount_(0),
+      journal_(nullptr),
+      journalBytes_(0),
+      failed_(false)
+{
+    acquireLock();
+    try { recover(); } catch (...) {
+        // Destructor tidak jalan jika konstruktor melempar, jadi kunci dilepas di sini.
+#ifdef _WIN32
+        _close(lockFd_);
+#else
+        close(lockFd_);
+#endif
+        throw;
+    }
+}
+
+SessionStore::~SessionStore() {
+    try { flush(); } catch (const std::exception&) { /* Tidak boleh melempar dari destructor */ }
+    if (journal_) fclose(journal_);
+#ifdef _WIN32
+    if (lockFd_ >= 0) _close(lockFd_);
+#else
+    if (lockFd_ >= 0) close(lockFd_); // Kunci ikut terlepas
+#endif
+}
+
+// Kunci milik OS (bukan sekadar ada/tidaknya file), jadi otomatis lepas jika proses crash.
+void SessionStore::acquireLock() {
+#ifdef _WIN32
+    lockFd_ = _open(lockPath_.c_str(), _O_RDWR | _O_CREAT, _S_IREAD | _S_IWRITE);
+    bool locked = lockFd_ >= 0 && _locking(lockFd_, _LK_NBLCK, 1) == 0;
+    if (!locked && lockFd_ >= 0) { _close(lockFd_); lockFd_ = -1; }
+#else
+    lockFd_ = open(lockPath_.c_str(), O_RDWR | O_CREAT, 0644);
+    bool locked = lockFd_ >= 0 && flock(lockFd_, LOCK_EX | LOCK_NB) == 0;
+    if (!locked && lockFd_ >= 0) { close(lockFd_); lockFd_ = -1; }
+#endif
+    if (!locked) throw std::runtime_error("File sesi sedang dipakai proses lain: " + lockPath_);
+}
+
+void SessionStore::recover() {
+    replayRecords(readWholeFile(snapshotPath_), records_);
+
+    std::vector<uint8_t> journalData = readWholeFile(journalPath_);
+    journalBytes_ = replayRecords(journalData, records_);
+    if (journalBytes_ < journalData.size()) {
+        // Ekor journal terpotong saat crash; buang supaya record baru tidak tertimpa sampah.
+        std::filesystem::resize_file(journalPath_, journalBytes_);
+    }
+
+    journal_ = fopen(journalPath_.c_str(), "ab");
+    if (!journal_) throw std::runtime_error("Tidak bisa membuka journal sesi: " + journalPath_);
+}
+
+void SessionStore::appendRecord(const std::string& sessionId, const std::vector<uint8_t>& payload) {
+    if (failed_) throw std::runtime_error("Journal sesi tidak bisa dipakai lagi: " + journalPath_);
+    appendFrame(pendingBatch_, sessionId, payload);
+    if (++pendingCount_ >= batchSize_) flush();
+}
+
+void SessionStore::save(const std::string& sessionId, const SessionState& state) {
+    std::vector<uint8_t> payload = encode(state);
+    auto it = records_.find(sessionId);
+    if (it != records_.end() && it->second == payload) return; // Tidak ada perubahan, tidak perlu record/fsync
+    records_[sessionId] = payload;
+    appendRecord(sessionId, payload);
+}
+
+void SessionStore::erase(const std::string& sessionId) {
+    if (records_.erase(sessionId) == 0) return;
+    appendRecord(sessionId, {});
+}
+
+bool SessionStore::load(const std::string& sessionId, SessionState& state) const {
+    auto it = records_.find(sessionId);
+    if (it == records_.end()) return false;
+    switch (decode(it->second, state)) {
+        case DecodeResult::OK:
+            break;
+        case DecodeResult::UNKNOWN_VERSION:
+            throw UnsupportedSessionVersionError("Sesi '" + sessionId + "' memakai format versi " +
+                                                 std::to_string(it->second[0]) + ", versi yang didukung " +
+                                                 std::to_string(SESSION_FORMAT_VERSION));
+        case DecodeResult::MALFORMED:
+            // CRC valid tapi isinya tidak lengkap/tidak masuk akal untuk versi ini.
+            throw std::runtime_error("Sesi '" + sessionId + "' rusak");
+    }
+    return true;
+}
+
+void SessionStore::flush() {
+    if (failed_) throw std::runtime_error("Journal sesi tidak bisa dipakai lagi: " + journalPath_);
+    writePendingBatch();
+    if (journalBytes_ > compactThresholdBytes_) compact();
+}
+
+void SessionStore::writePendingBatch() {
+    if (pendingBatch_.empty()) return;
+    try {
+        writeAndSync(journal_, pendingBatch_, journalPath_);
+    } catch (const std::runtime_error&) {
+        discardPartialWrite();
+        throw; // Batch tetap tertunda dan ditulis ulang utuh pada flush berikutnya
+    }
+    journalBytes_ += pendingBatch_.size();
+    pendingBatch_.clear();
+    pendingCount_ = 0;
+}
+
+// Tulisan batch yang gagal di tengah bisa meninggalkan sebagian record di journal.
+// Record berikutnya akan ditambahkan setelah sampah itu, dan recover() membuang semua
+// record sesudah sampah pertama; jadi journal dipotong kembali ke record valid terakhir.
+// Jika itu pun gagal, store ditandai rusak dan semua save berikutnya melempar.
+void SessionStore::discardPartialWrite() {
+    fclose(journal_); // Sisa buffer stdio ikut ditulis di sini, lalu dipotong di bawah
+    journal_ = nullptr;
+    std::error_code error;
+    std::filesystem::resize_file(journalPath_, journalBytes_, error);
+    if (!error) journal_ = fopen(journalPath_.c_str(), "ab");
+    if (!journal_) failed_ = true;
+}
+
+void SessionStore::compact() {
+    // Batch yang tertunda masuk journal dulu, supaya journal tidak pernah lebih lama
+    // dari snapshot jika crash terjadi sebelum journal dikosongkan.
+    writePendingBatch();
+
+    std::vector<uint8_t> snapshot;
+    for (const auto& entry : records_) appendFrame(snapshot, entry.first, entry.second);
+
+    std::string tempPath = snapshotPath_ + ".tmp";
+    FILE* out = fopen(tempPath.c_str(), "wb");
+    if (!out) throw std::runtime_error("Tidak bisa membuat snapshot sesi: " + tempPath);
+    try { writeAndSync(out, snapshot, tempPath); } catch (...) { fclose(out); throw; }
+    if (fclose(out) != 0) throw std::runtime_error("Gagal menutup snapshot sesi: " + tempPath);
+    std::filesystem::rename(tempPath, snapshotPath_);
+    // Snapshot baru harus tercatat di direktori sebelum journal lama dikosongkan.
+    syncParentDirectory(snapshotPath_);
+
+    fclose(journal_);
+    journal_ = fopen(journalPath_.c_str(), "wb");
+    if (!journal_) {
+        failed_ = true;
+        throw std::runtime_error("Tidak bisa membuka journal sesi: " + journalPath_);
+    }
+    journalBytes_ = 0;
+}
+
+std::vector<uint8_t> SessionStore::encode(const SessionState& state) {
+    std::vector<uint8_t> out;
+    out.reserve(64);
+    out.push_back(SESSION_FORMAT_VERSION);
+    const PlayerStats& p = state.playerStats;
+    for (int v : {p.hp, p.maxHp, p.sp, p.maxSp, p.attack, p.defense}) putU32(out, static_cast<uint32_t>(v));
+    out.push_back(static_cast<uint8_t>((state.inCombat ? 1 : 0) | (state.hasLegendarySword ? 2 : 0)));
+    out.push_back(static_cast<uint8_t>(state.defendOutcome));
+    putU32(out, static_cast<uint32_t>(state.combatEnemyHp));
+    putU32(out, state.rngState);
+    putString(out, state.currentSceneId);
+    putString(out, state.combatEnemyId);
+    return out;
+}
+
+SessionStore::DecodeResult SessionStore::decode(const std::vector<uint8_t>& payload, SessionState& state) {
+    PayloadReader in(payload);
+    if (payload.empty()) return DecodeResult::MALFORMED;
+    if (in.u8() != SESSION_FORMAT_VERSION) return DecodeResult::UNKNOWN_VERSION;
+    SessionState decoded;
+    decoded.playerStats.hp = in.i32();
+    decoded.playerStats.maxHp = in.i32();
+    decoded.playerStats.sp = in.i32();
+    decoded.playerStats.maxSp = in.i32();
+    decoded.playerStats.attack = in.i32();
+    decoded.playerStats.defense = in.i32();
+    uint8_t flags = in.u8();
+    decoded.inCombat = (flags & 1) != 0;
+    decoded.hasLegendarySword = (flags & 2) != 0;
+    uint8_t defendOutcome = in.u8();
+    if (defendOutcome > static_cast<uint8_t>(DefendResolution::SUCCESSFUL_BLOCK)) return DecodeResult::MALFORMED;
+    decoded.defendOutcome = static_cast<DefendResolution>(defendOutcome);
+    decoded.combatEnemyHp = in.i32();
+    decoded.rngState = in.u32();
+    decoded.currentSceneId = in.str();
+    decoded.combatEnemyId = in.str();
+    if (!in.ok()) return DecodeResult::MALFORMED;
+    state = decoded;
+    return DecodeResult::OK;
+}
@@ -0,0 +1,71 @@
+#ifndef SESSIONSTORE_H
+#define SESSIONSTORE_H
+
+#include "GameDataTypes.h" // Untuk SessionState
+#include <cstdint>
+#include <cstdio>          // Untuk FILE
+#include <stdexcept>       // Untuk std::runtime_error
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Sesi tersimpan ditulis versi format lain; tidak boleh ditimpa diam-diam.
+class UnsupportedSessionVersionError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+// Penyimpanan sesi yang tahan crash. Setiap save ditambahkan sebagai record biner
+// (versi + CRC32) ke journal write-ahead; record dikumpulkan per batch lalu
+// di-fsync sekaligus. Jika journal sudah besar, semua sesi terbaru ditulis ulang
+// ke file snapshot dan journal dikosongkan. Saat start, snapshot + journal dibaca
+// sekali dan record rusak di ekor journal (tulisan terpotong) dibuang.
+// Satu basePath hanya boleh dibuka satu SessionStore: file .lock dikunci selama
+// store hidup, dan pembuka kedua gagal dengan std::runtime_error. Batch lebih
+// dari 1 hanya berguna untuk host yang menyimpan banyak sesi dalam satu proses.
+class SessionStore {
+public:
+    SessionStore(const std::string& basePath, size_t batchSize = 64, size_t compactThresholdBytes = 4 * 1024 * 1024);
+    ~SessionStore();
+    SessionStore(const SessionStore&) = delete;
+    void operator=(const SessionStore&) = delete;
+
+    // Save yang isinya sama dengan record terakhir sesi itu diabaikan (tanpa tulisan journal).
+    void save(const std::string& sessionId, const SessionState& state);
+    void erase(const std::string& sessionId);
+    // false jika sesi tidak ada. Melempar UnsupportedSessionVersionError jika versi formatnya
+    // tidak dikenal, dan std::runtime_error biasa jika isinya rusak.
+    bool load(const std::string& sessionId, SessionState& state) const;
+    size_t getSessionCount() const { return records_.size(); }
+
+    void flush();
+    void compact();
+
+    enum class DecodeResult { OK, UNKNOWN_VERSION, MALFORMED };
+
+    static std::vector<uint8_t> encode(const SessionState& state);
+    static DecodeResult decode(const std::vector<uint8_t>& payload, SessionState& state);
+
+private:
+    std::string snapshotPath_;
+    std::string journalPath_;
+    std::string lockPath_;
+    int lockFd_;
+    size_t batchSize_;
+    size_t compactThresholdBytes_;
+
+    std::unordered_map<std::string, std::vector<uint8_t>> records_; // Payload terbaru per sesi
+    std::vector<uint8_t> pendingBatch_;
+    size_t pendingCount_;
+    FILE* journal_;
+    size_t journalBytes_;
+    bool failed_; // Journal tidak bisa dipulihkan setelah tulisan gagal
+
+    void acquireLock();
+    void recover();
+    void writePendingBatch();
+    void discardPartialWrite();
+    void appendRecord(const std::string& sessionId, const std::vector<uint8_t>& payload);
+};
+
+#endif // SESSIONSTORE_H
@@ -1,10 +1,72 @@
 #include "GameEngine.h" 
-// Tidak perlu #include <iostream> jika tidak ada output langsung di sini
+#include "EnemyBalancer.h"
+#include "SessionStore.h"
+#include <algorithm> // Untuk std::all_of
+#include <cctype>    // Untuk isalnum
+#include <iostream>
+#include <stdexcept>
+#include <string>
 // Tidak perlu srand() di sini jika sudah ada di konstruktor GameEngine
 
-int main() {
-    GameEngine game;
-    game.initializeGame();
-    game.run();
+// Mode balancing: Game.exe --balance [file_target] [file_output]
+// file_target kosong atau "-" berarti memakai target bawaan.
+int runEnemyBalancer(int argc, char* argv[]) {
+    try {
+        const std::map<std::string, Enemy>& blueprints = GameWorld::getShared()->getEnemyBlueprints();
+        std::string targetsPath = (argc > 2) ? argv[2] : "";
+        std::vector<BalanceTarget> targets = (targetsPath.empty() || targetsPath == "-")
+            ? EnemyBalancer::defaultTargets() : EnemyBalancer::loadTargets(targetsPath, blueprints);
+        std::string outputPath = (argc > 3 && argv[3][0] != '\0') ? argv[3] : "tuned_enemies.txt";
+
+        EnemyBalancer balancer(PLAYER_STARTING_STATS);
+        EnemyBalancer::writeBlueprints(outputPath, balancer.balanceAll(blueprints, targets));
+        std::cout << "Blueprint musuh hasil balancing ditulis ke " << outputPath << std::endl;
+    } catch (const std::runtime_error& e) {
+        std::cerr << "Error balancing: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--balance") {
+        return runEnemyBalancer(argc, argv);
+    }
+    // Sesi disimpan tiap giliran: Game.exe [--session <id>]
+    std::string sessionId = (argc > 2 && std::string(argv[1]) == "--session") ? argv[2] : "default";
+    bool validId = !sessionId.empty() && std::all_of(sessionId.begin(), sessionId.end(), [](char c) {
+        return isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_';
+    });
+    if (!validId) {
+        std::cerr << "Error sesi: id sesi hanya boleh berisi huruf, angka, '-' dan '_'." << std::endl;
+        return 1;
+    }
+    try {
+        // Satu proses = satu sesi, jadi tiap sesi punya file sendiri dan tiap giliran
+        // langsung di-fsync (batch 1).
+        SessionStore sessionStore("heismay_session_" + sessionId, 1);
+        GameEngine game;
+        game.initializeGame();
+        SessionState savedSession;
+        try {
+            if (sessionStore.load(sessionId, savedSession)) {
+                game.restoreSession(savedSession);
+                std::cout << "Melanjutkan sesi tersimpan '" << sessionId << "'..." << std::endl;
+            }
+        } catch (const UnsupportedSessionVersionError&) {
+            throw; // Sesi dari versi lain: tolak, jangan dihapus
+        } catch (const std::runtime_error& e) {
+            std::cerr << "Peringatan: sesi '" << sessionId << "' tidak bisa dipulihkan (" << e.what()
+                      << "). Memulai permainan baru." << std::endl;
+            sessionStore.erase(sessionId);
+            sessionStore.flush();
+            game.initializeGame();
+        }
+        game.attachSessionStore(&sessionStore, sessionId);
+        game.run();
+    } catch (const std::runtime_error& e) {
+        std::cerr << "Error sesi: " << e.what() << std::endl;
+        return 1;
+    }
     return 0;
-}
\ No newline at end of file
+}